@@ -15,31 +15,23 @@
 
 #include "utilities.h"
 
-#ifdef WIN32
-#define random() rand()
-#endif
-
 using namespace std;
 using namespace cv;
 
-double randDouble() {
-    static bool didSeeding = false;
+// generator state of the calling thread, so trackers running on several
+// threads neither race on nor perturb each other's random tests
+static __thread unsigned int randState = 1;
 
-    if (!didSeeding) {
-        srand(time(0));
-        didSeeding = true;
-    }
-    return random()/(RAND_MAX + 1.0);
+void seedRand(const unsigned int seed) {
+    randState = seed;
 }
 
-double randnDouble() {
-	static bool didSeeding = false;
+double randDouble() {
+    return rand_r(&randState)/(RAND_MAX + 1.0);
+}
 
-    if (!didSeeding) {
-        srand(time(0));
-        didSeeding = true;
-    }
-    return 2.0*(random()/(RAND_MAX + 1.0)) - 1.0;
+double randnDouble() {
+    return 2.0*(rand_r(&randState)/(RAND_MAX + 1.0)) - 1.0;
 }
 
 int randIntFromRange(const int from, const int range) {
@@ -49,21 +41,13 @@ int randIntFromRange(const int from, const int range) {
 // adapted from GNU Scientific Library
 double randGauss( double std_dev )
 {
-    static bool didSeeding = false;
-
-    if (!didSeeding) {
-        srand(0);
-        didSeeding = true;
-    }
-
-
   double x, y, r2;
 
   do
     {
       /* choose x,y in uniform square (-1,-1) to (+1,+1) */
-      x = -1.0 + 2.0 * (random() / (double)RAND_MAX);
-      y = -1.0 + 2.0 * (random() / (double)RAND_MAX);
+      x = -1.0 + 2.0 * (rand_r(&randState) / (double)RAND_MAX);
+      y = -1.0 + 2.0 * (rand_r(&randState) / (double)RAND_MAX);
 
       /* see if it is in the unit circle */
       r2 = x * x + y * y;
@@ -24,6 +24,9 @@ inline double sigmoid(double x)
 	return 1.0/(1.0+exp(-x));
 }
 
+//! Seeds the random numbers drawn on the calling thread
+void seedRand(const unsigned int seed);
+
 //! Returns a random number in [0, 1]
 double randDouble();
 
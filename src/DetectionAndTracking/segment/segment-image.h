@@ -25,19 +25,25 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
 #include "filter.h"
 #include "segment-graph.h"
 
+// random component of a color; from the caller's generator state if
+// given, so concurrent segmentations do not race on random()
+static inline int random_component(unsigned int *seed) {
+  return seed != 0 ? rand_r(seed) : random();
+}
+
 // random color
-rgb random_rgb(){ 
+rgb random_rgb(unsigned int *seed = 0){ 
   rgb c;
 
-  c.r = random();
-  c.g = random();
-  c.b = random();
+  c.r = random_component(seed);
+  c.g = random_component(seed);
+  c.b = random_component(seed);
 
   // exclude black since that's the mask color used in the image provided by --mbari-mask-path, e.g.
   while (c.r == 0 && c.g == 0 && c.b == 0) {
-      c.r = random();
-      c.g = random();
-      c.b = random();
+      c.r = random_component(seed);
+      c.g = random_component(seed);
+      c.b = random_component(seed);
   }
 
   return c;
@@ -62,8 +68,10 @@ static inline float diff(image<float> *r, image<float> *g, image<float> *b,
  * min_size: minimum component size (enforced by post-processing stage).
  * scaleW: amount to scale X seedWinner
  * scaleH: amount to scale H seedWinner.
+ * seed: state the component colors are drawn from with rand_r(); random() if null.
  */
-image<rgb> *segment_image(image<rgb> *im, float sigma, float c, int min_size, float scaleW, float scaleH) {
+image<rgb> *segment_image(image<rgb> *im, float sigma, float c, int min_size, float scaleW, float scaleH,
+                          unsigned int *seed = 0) {
   int width = im->width();
   int height = im->height();
 
@@ -141,7 +149,7 @@ image<rgb> *segment_image(image<rgb> *im, float sigma, float c, int min_size, fl
   // pick random colors for each component
   rgb *colors = new rgb[width*height];
   for (int i = 0; i < width*height; i++)
-    colors[i] = random_rgb();
+    colors[i] = random_rgb(seed);
 
   bool found;
   rgb seedColor;
@@ -0,0 +1,64 @@
+#!/bin/bash
+#
+# Run mbarivision on synthetic clips with the brain and the fast saliency
+# engine, and report the frames per second of each engine and how many of
+# the event objects of one run are found by the other.
+#
+# usage: engines.sh <bindir> <workdir>
+
+BINDIR=${1:?usage: engines.sh <bindir> <workdir>}
+WORKDIR=${2:?usage: engines.sh <bindir> <workdir>}
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+ENGINES="Brain Fast"
+
+failed=0
+total=0
+summary=$(printf "%-16s %12s %12s %8s\n" "clip" "Brain fps" "Fast fps" "speedup")
+
+while read -r name pixels minmatch args; do
+  case "$name" in ""|\#*) continue;; esac
+
+  total=$((total + 1))
+
+  # the options after -- go to mbarivision
+  args="$args "
+  video=${args%% -- *}
+  options=${args#* -- }
+
+  echo "==== $name"
+  declare -A fps=()
+  ok=1
+  for engine in $ENGINES; do
+    out=$WORKDIR/$name/$engine
+    rm -rf "$out"
+    mkdir -p "$out"
+    if ! "$BINDIR/mbaribench" --workdir="$out" --mbarivision="$BINDIR/mbarivision" $video -- \
+         --mbari-save-events-xml="$out/events.xml" \
+         --mbari-saliency-engine=$engine \
+         $options > "$out/log.txt" 2>&1; then
+      echo "$name: mbarivision failed with the $engine engine, see $out/log.txt"
+      ok=0
+      break
+    fi
+    fps[$engine]=$(awk '$1 == "frames/sec" { print $2 }' "$out/log.txt")
+  done
+
+  if [ $ok -eq 1 ]; then
+    summary="$summary
+$(printf "%-16s %12s %12s %7.2fx" "$name" "${fps[Brain]}" "${fps[Fast]}" \
+      "$(echo "${fps[Fast]} ${fps[Brain]}" | awk '{ print ($2 > 0 ? $1/$2 : 0) }')")"
+    if ! "$BINDIR/mbaricompare" --match="$pixels" --min-match="$minmatch" \
+         "$WORKDIR/$name/Brain/events.xml" "$WORKDIR/$name/Fast/events.xml"; then
+      echo "$name: the Fast engine finds less than $minmatch of the Brain engine's objects or the other way round"
+      ok=0
+    fi
+  fi
+  [ $ok -eq 1 ] || failed=$((failed + 1))
+done < "$HERE/engines"
+
+echo
+echo "$summary"
+echo
+echo "$((total - failed)) of $total clips matched"
+[ $failed -eq 0 ]
@@ -0,0 +1,65 @@
+#!/bin/bash
+#
+# Run mbarivision on short synthetic clips with pinned options and compare
+# the events XML, positions and property files of each case with those of
+# its reference case, run by the same build.
+#
+# usage: run.sh <bindir> <workdir>
+
+BINDIR=${1:?usage: run.sh <bindir> <workdir>}
+WORKDIR=${2:?usage: run.sh <bindir> <workdir>}
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+FILES="events.xml positions.txt properties.txt"
+
+# the creation date and the version comment change from run to run
+IGNORE=(--ignore='CreationDate="[^"]*"' --ignore='<!--.*-->')
+
+failed=0
+total=0
+
+while read -r name reference tolerance args; do
+  case "$name" in ""|\#*) continue;; esac
+
+  total=$((total + 1))
+  out=$WORKDIR/$name
+  rm -rf "$out"
+  mkdir -p "$out"
+
+  # the options after -- go to mbarivision
+  args="$args "
+  video=${args%% -- *}
+  options=${args#* -- }
+
+  echo "==== $name"
+  if ! "$BINDIR/mbaribench" --workdir="$out" --mbarivision="$BINDIR/mbarivision" $video -- \
+       --mbari-save-events-xml="$out/events.xml" \
+       --mbari-save-positions="$out/positions.txt" \
+       --mbari-save-properties="$out/properties.txt" \
+       $options > "$out/log.txt" 2>&1; then
+    echo "$name: mbarivision failed, see $out/log.txt"
+    failed=$((failed + 1))
+    continue
+  fi
+
+  # reference runs are only compared with by later cases
+  if [ "$reference" == "-" ]; then continue; fi
+
+  if [ ! -f "$WORKDIR/$reference/events.xml" ]; then
+    echo "$name: reference case $reference has no output; it must be listed and pass first"
+    failed=$((failed + 1))
+    continue
+  fi
+
+  for f in $FILES; do
+    if ! "$BINDIR/mbaricompare" --tolerance="$tolerance" "${IGNORE[@]}" \
+         "$WORKDIR/$reference/$f" "$out/$f"; then
+      failed=$((failed + 1))
+      echo "$name: $f differs from $reference"
+      break
+    fi
+  done
+done < "$HERE/cases"
+
+echo "$((total - failed)) of $total cases passed"
+[ $failed -eq 0 ]